@@ -87,6 +87,21 @@ sub main
     my $heap_free_chunks =
         ::read32 ::findSymbolAddress("HeapManager::cv_free_chunks");
 
+    my $mag_hits =
+        ::read32 ::findSymbolAddress("HeapManager::cv_magazine_hits");
+
+    my $mag_misses =
+        ::read32 ::findSymbolAddress("HeapManager::cv_magazine_misses");
+
+    my $mag_refills =
+        ::read32 ::findSymbolAddress("HeapManager::cv_magazine_refills");
+
+    my $realloc_copy =
+        ::read64 ::findSymbolAddress("HeapManager::cv_realloc_copy_bytes");
+
+    my $realloc_inplace =
+        ::read64 ::findSymbolAddress("HeapManager::cv_realloc_inplace_bytes");
+
     my $heap_total = $big_heap_pages_used + $small_heap_pages_used;
     my $heap_max = $big_heap_max + $small_heap_pages_used;
 
@@ -110,6 +125,10 @@ sub main
     ::userDisplay "    Max. Pages used by heap: $heap_max\n";
     ::userDisplay "    heap free bytes/chunks   $heap_free/$heap_free_chunks (valid only after a coalescing)\n";
     ::userDisplay "    Heap chunks coalesced:   $heap_coal\n";
+    ::userDisplay "    Magazine hits/misses:    $mag_hits/$mag_misses ".
+                  "($mag_refills chunks refilled)\n";
+    ::userDisplay "    Realloc bytes copied:    $realloc_copy ".
+                  "($realloc_inplace grown in place)\n";
     ::userDisplay "\nVirtual Memory Manager page eviction requests:\n";
     ::userDisplay "    RO page requests:        $castout_ro\n";
     ::userDisplay "    RW page requests:        $castout_rw\n";
@@ -0,0 +1,87 @@
+#!/usr/bin/perl
+# IBM_PROLOG_BEGIN_TAG
+# This is an automatically generated prolog.
+#
+# $Source: src/build/debug/Hostboot/Sched.pm $
+#
+# OpenPOWER HostBoot Project
+#
+# Contributors Listed Below - COPYRIGHT 2017
+# [+] International Business Machines Corp.
+#
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or
+# implied. See the License for the specific language governing
+# permissions and limitations under the License.
+#
+# IBM_PROLOG_END_TAG
+
+use strict;
+
+package Hostboot::Sched;
+use Exporter;
+our @EXPORT_OK = ('main');
+
+use constant SCHED_INSTANCE_NAME =>
+                "Singleton<Scheduler>::instance()::instance";
+use constant SCHED_RUNQUEUES_OFFSET => 0;
+
+use constant RUNQUEUE_CPU_OFFSET => 0;
+use constant RUNQUEUE_CTXSWITCH_OFFSET => 8;
+use constant RUNQUEUE_STEALS_OFFSET => 16;
+use constant RUNQUEUE_NEXT_OFFSET => 24;
+
+use constant CPU_PIR_OFFSET => 16;
+
+sub main
+{
+    my ($packName, $args) = @_;
+
+    my ($symAddr, $symSize) = ::findSymbolAddress(SCHED_INSTANCE_NAME);
+    if (not defined $symAddr)
+    {
+        ::userDisplay "Couldn't find ".SCHED_INSTANCE_NAME;
+        die;
+    }
+
+    #only read bottom 32 bits of ptr to handle AbaPtr
+    my $runqueue = ::read32($symAddr + SCHED_RUNQUEUES_OFFSET + 4);
+
+    my $totalSwitches = 0;
+    my $totalSteals = 0;
+
+    ::userDisplay "  PIR    Context switches    Steals\n";
+    while (0 != $runqueue)
+    {
+        my $cpu = ::read64($runqueue + RUNQUEUE_CPU_OFFSET);
+        my $pir = ::read32($cpu + CPU_PIR_OFFSET);
+        my $switches = ::read64($runqueue + RUNQUEUE_CTXSWITCH_OFFSET);
+        my $steals = ::read64($runqueue + RUNQUEUE_STEALS_OFFSET);
+
+        ::userDisplay(sprintf("%5d    %16d    %6d\n",
+                              $pir, $switches, $steals));
+
+        $totalSwitches += $switches;
+        $totalSteals += $steals;
+
+        $runqueue = ::read32($runqueue + RUNQUEUE_NEXT_OFFSET + 4);
+    }
+    ::userDisplay(sprintf("Total    %16d    %6d\n",
+                          $totalSwitches, $totalSteals));
+}
+
+sub helpInfo
+{
+    my %info = (
+        name => "Sched",
+        intro => ["Displays per-CPU scheduler statistics."],
+    );
+}
@@ -32,10 +32,13 @@ use Exporter;
 our @EXPORT_OK = ('main');
 
 use constant TRACE_BUFFER_COUNT => 2;
+use constant TRACE_BUFFER_LANES => 8;
 use constant DAEMON_FIRST_BUFFER_PAGE_OFFSET => 8;
 use constant DAEMON_FIRST_TEMP_BUFFER_PAGE_OFFSET =>
                     DAEMON_FIRST_BUFFER_PAGE_OFFSET + 16;
-use constant BUFFER_FIRST_PAGE_OFFSET => 16;
+use constant BUFFER_LANES_OFFSET => 128;
+use constant BUFFER_LANE_SIZE => 128;
+use constant BUFFER_LANE_FIRST_PAGE_OFFSET => 0;
 use constant BUFFER_PAGE_NEXT_OFFSET => 0;
 use constant BUFFER_PAGE_PREV_OFFSET => BUFFER_PAGE_NEXT_OFFSET + 8;
 use constant BUFFER_PAGE_SIZE_OFFSET => BUFFER_PAGE_PREV_OFFSET + 12;
@@ -97,7 +100,7 @@ sub main
         my $firstPage = ::read64($daemonAddr + DAEMON_FIRST_BUFFER_PAGE_OFFSET);
         readPage($firstPage, BUFFER_PAGE_PREV_OFFSET, \@bufferPages);
 
-        for(my $i = 0; $i < TRACE_BUFFER_COUNT; $i++)
+        for(my $i = 0; $i < TRACE_BUFFER_COUNT * TRACE_BUFFER_LANES; $i++)
         {
             my $page =
                 ::read64($daemonAddr + DAEMON_FIRST_TEMP_BUFFER_PAGE_OFFSET +
@@ -110,10 +113,15 @@ sub main
     for(my $i = 0; $i < TRACE_BUFFER_COUNT; $i++)
     {
         my $buffer = ::read64($serviceAddr + 8*$i);
-        my $page = ::read64($buffer + BUFFER_FIRST_PAGE_OFFSET);
-        $page = extractABAptr($page);
+        for(my $lane = 0; $lane < TRACE_BUFFER_LANES; $lane++)
+        {
+            my $page = ::read64($buffer + BUFFER_LANES_OFFSET +
+                                BUFFER_LANE_SIZE*$lane +
+                                BUFFER_LANE_FIRST_PAGE_OFFSET);
+            $page = extractABAptr($page);
 
-        readPage($page, BUFFER_PAGE_PREV_OFFSET, \@bufferPages);
+            readPage($page, BUFFER_PAGE_PREV_OFFSET, \@bufferPages);
+        }
     }
 
     while(@bufferPages)
@@ -34,8 +34,11 @@ ifdef MODULE
 COMMONFLAGS += -fPIC -Bsymbolic -Bsymbolic-functions
 CFLAGS += -D__HOSTBOOT_MODULE=$(MODULE)
 CFLAGS += -DNO_INITIALIZER_LIST
-CFLAGS += -DPLAT_NO_THREAD_LOCAL_STORAGE
 CFLAGS += -D__FAPI
+# Thread local storage is only provided by the IPL time C library
+ifdef HOSTBOOT_RUNTIME
+CFLAGS += -DPLAT_NO_THREAD_LOCAL_STORAGE
+endif
 endif
 
 COMMONFLAGS += $(OPT_LEVEL) -nostdlib
@@ -38,6 +38,7 @@
 #define EINVAL          22      // Invalid argument
 #define ENFILE          23      // Too many open files in system
 #define EDEADLK         35      // Operation would cause deadlock.
+#define ENOSYS          38      // Function not implemented
 #define ETIME           62      // Time expired.
 #define EALREADY        114     // Operation already in progress
 
@@ -53,6 +53,19 @@ typedef _barrier_imp_t barrier_t;
 
 #define MUTEX_INITIALIZER {0}
 
+/**
+ * Mutex contention statistics, only collected in HOSTBOOT_DEBUG builds.
+ */
+struct _mutex_stats_t
+{
+    uint64_t acquisitions;  ///< Number of times the mutex was locked.
+    uint64_t spins;         ///< Contended locks satisfied by spinning.
+    uint64_t sleeps;        ///< Times a locker blocked on the futex.
+    uint64_t max_hold;      ///< Longest hold time, in timebase ticks.
+};
+
+typedef _mutex_stats_t mutex_stats_t;
+
 /**
  * Conditional variable types
  */
@@ -115,13 +128,20 @@ void mutex_init(mutex_t * o_mutex);
  * @brief Destroy / uninitialize a mutex object.
  * @param[in] i_mutex - the mutex
  * @note This does not free the memory associated with the object if the mutex
- *       was allocated off the heap.
+ *       was allocated off the heap.  Its statistics, if any, are released.
  */
 void mutex_destroy(mutex_t * i_mutex);
 
 /**
  * @fn mutex_lock
  * @brief Obtain a lock on a mutex
+ *
+ * If the mutex is held and nobody is blocked on it, the caller polls it at
+ * low thread priority before blocking in the kernel, since most critical
+ * sections are shorter than a futex system call.  How long it polls adapts
+ * to how long polling recently took to get the mutex.  Mutexes hashing to
+ * the same slot share that history.
+ *
  * @param[in] i_mutex - The mutex
  * @post returns when this task has the lock
  */
@@ -135,6 +155,17 @@ void mutex_lock(mutex_t * i_mutex);
  */
 void mutex_unlock(mutex_t * i_mutex);
 
+/**
+ * @fn mutex_get_stats
+ * @brief Read the contention statistics for a mutex
+ * @param[in] i_mutex - the mutex
+ * @param[out] o_stats - the statistics collected since mutex_init
+ * @return 0 on success, ENOENT if the mutex is not tracked, ENOSYS if
+ *         statistics are not collected.  They are only collected when
+ *         libc is built with HOSTBOOT_DEBUG.
+ */
+int mutex_get_stats(mutex_t * i_mutex, mutex_stats_t * o_stats);
+
 /**
  * @fn sync_cond_init
  * @brief Initialize a condtional variable
@@ -153,6 +153,32 @@ void task_affinity_unpin();
  */
 void task_affinity_migrate_to_master();
 
+/** @enum task_priority
+ *  @brief Scheduling priority classes for a task.
+ */
+enum task_priority
+{
+        /** Default class for all tasks. */
+    TASK_PRIORITY_NORMAL = 0,
+        /** Latency-sensitive service tasks, such as resource providers and
+         *  daemons which page faults or interrupts wait on.  These run
+         *  ahead of, and preempt, normal priority tasks. */
+    TASK_PRIORITY_HIGH = 1,
+};
+
+/** @fn task_set_priority
+ *  @brief Set the scheduling priority class of the calling task.
+ *
+ *  See POSIX sched_setscheduler.
+ *
+ *  @param[in] i_priority - Priority class from the task_priority enum.
+ *
+ *  @return 0 or negative number on error.
+ *
+ *  @retval EINVAL - Unknown priority class.
+ */
+int task_set_priority(task_priority i_priority);
+
 /** @enum task_status
  *  @brief Status of how a task exited.
  */